@@ -14,6 +14,21 @@
 *   - excluir_lista
 *   - carregar_dados
 *   - salvar_dados
+*   - criar_catalogo
+*   - inserir_catalogo
+*   - remover_catalogo
+*   - atualizar_catalogo
+*   - buscar_catalogo
+*   - buscar_catalogo_modelo
+*   - tamanho_catalogo
+*   - filtrar_catalogo
+*   - salvar_catalogo
+*   - carregar_catalogo
+*   - excluir_catalogo
+* Compilao:
+*   - programa: gcc main.c -o lista -pthread
+*   - verificao do catlogo: gcc -DTESTE main.c -o teste -pthread && ./teste
+*   - benchmark do catlogo: gcc -O2 -DBENCHMARK main.c -o benchmark -pthread && ./benchmark [itens] [max_threads]
 * Autor: Lucas de Oliveira Lima
 * Ultima alterao: 29/09/2024
 ***********************************************************/
@@ -21,13 +36,30 @@
 /*Import das libs*/
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#ifdef BENCHMARK
+#include <time.h>
+#endif
 
 /*Definio de constante para controle do tamanho do array de itens*/
 #define TAMANHO 5
 
+/*Definio de constante para controle do tamanho do nome do modelo*/
+#define TAMANHO_MODELO 20
+
+/*Definio de constante para controle do nmero de parties do catlogo por ncleo disponvel. Mais parties do que
+  trabalhadores permitem que um trabalhador que termina cedo assuma parties ainda no iniciadas*/
+#define PARTICOES_POR_NUCLEO 4
+
+/*Definio do prefixo dos arquivos das parties do catlogo (arquivo_<indice>.txt)*/
+#define PREFIXO_CATALOGO "arquivo"
+
 /*Definio da estrutura Processador*/
 typedef struct{
-    char modelo[20];
+    char modelo[TAMANHO_MODELO];
     int numero_cores;
     int numero_threads;
     int litografia_nm;
@@ -40,9 +72,49 @@ typedef struct{
 /*Definio da estrutura Lista*/
 typedef struct{
     int id;
+    int capacidade;
     Processador *itens;
 }Lista;
 
+/*Definio da estrutura Tarefa, usada para repassar a cada trabalhador os dados da partio que ele deve percorrer*/
+typedef struct{
+    Lista *lista;
+    pthread_mutex_t *trava;
+    int indice;
+    int inicio;
+    int quantidade;
+    Processador *itens;
+    int min_cores;
+    int resultado;
+    char *prefixo;
+    char *conteudo;
+}Tarefa;
+
+/*Definio da estrutura Catalogo, composta por vrias listas (parties) com uma trava para cada partio e por um
+  conjunto fixo de trabalhadores que reivindicam as parties de cada operao paralela por meio de um contador atmico*/
+typedef struct{
+    int num_particoes;
+    Lista **particoes;
+    pthread_mutex_t *travas;
+
+    // Trabalhadores criados em criar_catalogo e encerrados em liberar_catalogo
+    int num_trabalhadores;
+    pthread_t *trabalhadores;
+
+    // Rodada atual: tarefas, funo executada, prxima tarefa livre e trabalhadores que j terminaram
+    pthread_mutex_t trava_execucao;
+    pthread_mutex_t trava_pool;
+    pthread_cond_t tem_trabalho;
+    pthread_cond_t rodada_concluida;
+    Tarefa *tarefas;
+    void *(*funcao)(void *);
+    int total_tarefas;
+    atomic_int proxima;
+    int finalizados;
+    unsigned int geracao;
+    int encerrar;
+}Catalogo;
+
 /* Nome: criar_lista
  * Parametros: void
  * Retorno:
@@ -70,8 +142,9 @@ Lista* criar_lista(){
         return NULL;
     }
 
-    // Inicializa o contador de itens
+    // Inicializa o contador de itens e a capacidade do vetor de itens
     lista->id = 0;
+    lista->capacidade = TAMANHO;
 
     return lista;
 }
@@ -94,7 +167,7 @@ int inserir_elemento(Lista *lista, Processador *processador){
     }
 
     // Aborta a funo caso no exista espao disponvel no vetor de itens
-    if(lista->id > TAMANHO){
+    if(lista->id >= lista->capacidade){
         printf("\nLista cheia\n");
         return 0;
     }
@@ -130,7 +203,7 @@ int inserir_elemento_id(Lista *lista, Processador *processador, int pos){
     }
 
     // Aborta a funo caso no exista espao disponvel no vetor de itens
-    if(lista->id > TAMANHO){
+    if(lista->id >= lista->capacidade){
         printf("\nLista cheia\n");
         return 0;
     }
@@ -182,7 +255,7 @@ int inserir_elemento_inicio(Lista *lista, Processador *processador){
     }
 
     // Verifica se h espao disponvel no vetor de itens
-    if(lista->id < TAMANHO){
+    if(lista->id < lista->capacidade){
         for(i = lista->id; i > 0; i--){
         // Empurra todos os itens para a direita
         lista->itens[i] = lista->itens[i-1];
@@ -241,6 +314,26 @@ void listar_elementos(Lista *lista){
     return;
 }
 
+/* Nome: retirar_item
+ * Parametros:
+ *    - Lista *lista: o ponteiro que contm o endereo da lista;
+ *    - int pos: a posio vlida (de 1 at lista->id) do item a ser retirado.
+ * Retorno: void
+ * Descrio: Funo responsvel por retirar um item do vetor, empurrando os itens seguintes para a esquerda, sem exibir mensagens.
+ */
+void retirar_item(Lista *lista, int pos){
+
+    int j;
+
+    // Empurra todos os itens para a esquerda, sobrescrevendo o item a ser removido
+    for(j = pos - 1; j < lista->id - 1; j++){
+        lista->itens[j] = lista->itens[j + 1];
+    }
+
+    // Atualiza o contador de itens
+    lista->id--;
+}
+
 /* Nome: remover_elemento
  * Parametros:
  *    - Lista *lista: o ponteiro que contm o endereo do processador
@@ -252,8 +345,6 @@ void listar_elementos(Lista *lista){
  */
 int remover_elemento(Lista *lista, int pos){
 
-    int i, j;
-
     // Aborta a funo caso a lista no exista
     if(lista == NULL){
         printf("Lista nao inicializada\n");
@@ -262,17 +353,9 @@ int remover_elemento(Lista *lista, int pos){
 
     //Verifica se a posio  vlida
     if(pos > 0 && pos <= lista->id){
-        for(i = 0; i < lista->id; i++){
-
-            // Verifica se a posio no vetor corresponde ao item a ser excluido
-            if(i == pos - 1){
-                for(j = i; j < lista->id; j++){
 
-                    // Empurra todos os itens para a esquerda, sobrescrevendo o item a ser removido
-                    lista->itens[j] = lista->itens[j+1];
-                }
-            }
-        }
+        // Retira o item, empurrando os itens seguintes para a esquerda
+        retirar_item(lista, pos);
 
     // Aborta a funo caso a posio seja menor que zero ou superior a quantidade de itens no vetor
     } else {
@@ -280,9 +363,6 @@ int remover_elemento(Lista *lista, int pos){
         return 0;
     }
 
-    // Atualiza o contador de itens
-    lista->id--;
-
     printf("Item removido!\n");
 
     return 1;
@@ -498,171 +578,1459 @@ int salvar_dados(Lista *lista){
     return 1;
 }
 
-int main() {
+/* Nome: processar_tarefas
+ * Parametro: Catalogo *catalogo: o ponteiro que contm o endereo do catlogo.
+ * Retorno: void
+ * Descrio: Funo responsvel por reivindicar, pelo contador atmico, a prxima tarefa livre da rodada atual e execut-la,
+ *            at que no restem tarefas. Assim um trabalhador que termina cedo assume as parties ainda no iniciadas.
+ */
+void processar_tarefas(Catalogo *catalogo){
 
-    // Define um ponteiro do tipo Lista
-    Lista *lista = NULL;
+    int i;
 
-    // Define um ponteiro do tipo Processador
-    Processador *p = (Processador*) malloc(sizeof(Processador));
+    while((i = atomic_fetch_add(&catalogo->proxima, 1)) < catalogo->total_tarefas){
+        catalogo->funcao(&catalogo->tarefas[i]);
+    }
+}
 
-    // opcao: captura a navegao no menu do usuario. posicao: recebe a posicao no vetor de itens para alteraes
-    int opcao, posicao;
+/* Nome: trabalhador_pool
+ * Parametro: void *arg: o ponteiro para o Catalogo ao qual o trabalhador pertence.
+ * Retorno: NULL
+ * Descrio: Funo executada por cada trabalhador do catlogo. Aguarda uma nova rodada, processa tarefas at que acabem,
+ *            avisa que terminou e volta a aguardar, at que o catlogo seja encerrado.
+ */
+void* trabalhador_pool(void *arg){
 
-    // Cria a lista, o vetor de itens e configura o contador interno
-    lista = criar_lista();
+    Catalogo *catalogo = (Catalogo*) arg;
+    unsigned int vista = 0;
 
-    do{
-        // MENU PRINCIPAL
-        printf("------ CADASTRO DE ITENS -------\n");
-        printf("\nEscolha uma opcao: \n");
-        printf("  1 - Inserir um item no fim da lista\n");
-        printf("  2 - Inserir um item na posicao desejada\n");
-        printf("  3 - Inserir um item no inicio da lista\n");
-        printf("  4 - Exibir todos os itens cadastrados\n");
-        printf("  5 - Remover um item da lista\n");
-        printf("  6 - Alterar um item da lista\n");
-        printf("  7 - Pesquisar um item da lista\n");
-        printf("  8 - Exibir a quantidade de itens cadastrados\n");
-        printf("  9 - Excluir a lista\n");
-        printf(" 10 - Ler os itens do arquivo de cadastro\n");
-        printf(" 11 - Salvar os itens no arquivo de cadastro\n");
-        printf("  0 - Sair do programa\n\n");
-        printf("Opcao: ");
-        scanf("%d", &opcao);
+    pthread_mutex_lock(&catalogo->trava_pool);
+    while(1){
 
-        // Captura a opo do usurio
-        switch(opcao){
-            case 1:
-                printf("\n------ INSERIR ITEM NO FIM DA LISTA -------\n\n");
-                printf("Digite o modelo do processador: ");
-                scanf(" %[^\n]", p->modelo);
-                printf("Digite o numero de cores: ");
-                scanf("%d", &p->numero_cores);
-                printf("Digite o numero de threads: ");
-                scanf("%d", &p->numero_threads);
-                printf("Digite a litografia: ");
-                scanf("%d", &p->litografia_nm);
-                printf("Digite o clock basico: ");
-                scanf("%f", &p->clock_basico_ghz);
-                printf("Digite o clock maximo: ");
-                scanf("%f", &p->clock_maximo_ghz);
-                printf("Digite a TDP: ");
-                scanf("%d", &p->tdp_watts);
-                printf("Digite se o processador possui video integrado( s para sim ou n para nao): ");
-                scanf(" %c", &p->video_integrado);
+        // Aguarda uma nova rodada ou o encerramento do catlogo
+        while(!catalogo->encerrar && catalogo->geracao == vista){
+            pthread_cond_wait(&catalogo->tem_trabalho, &catalogo->trava_pool);
+        }
+        if(catalogo->encerrar){
+            break;
+        }
+        vista = catalogo->geracao;
+        pthread_mutex_unlock(&catalogo->trava_pool);
 
-                inserir_elemento(lista, p);
-                break;
-            case 2:
-                printf("\n------ INSERIR ITEM NA POSICAO DESEJADA -------\n\n");
-                printf("Digite o modelo do processador: ");
-                scanf(" %[^\n]", p->modelo);
-                printf("Digite o numero de cores: ");
-                scanf("%d", &p->numero_cores);
-                printf("Digite o numero de threads: ");
-                scanf("%d", &p->numero_threads);
-                printf("Digite a litografia: ");
-                scanf("%d", &p->litografia_nm);
-                printf("Digite o clock basico: ");
-                scanf("%f", &p->clock_basico_ghz);
-                printf("Digite o clock maximo: ");
-                scanf("%f", &p->clock_maximo_ghz);
-                printf("Digite a TDP: ");
-                scanf("%d", &p->tdp_watts);
-                printf("Digite se o processador possui video integrado( s para sim ou n para nao): ");
-                scanf(" %c", &p->video_integrado);
-                printf("Digite a posicao desejada: ");
-                scanf("%d", &posicao);
+        processar_tarefas(catalogo);
 
-                inserir_elemento_id(lista, p, posicao);
-                break;
-            case 3:
-                printf("\n------ INSERIR ITEM NO INICIO DA LISTA -------\n\n");
-                printf("Digite o modelo do processador: ");
-                scanf(" %[^\n]", p->modelo);
-                printf("Digite o numero de cores: ");
-                scanf("%d", &p->numero_cores);
-                printf("Digite o numero de threads: ");
-                scanf("%d", &p->numero_threads);
-                printf("Digite a litografia: ");
-                scanf("%d", &p->litografia_nm);
-                printf("Digite o clock basico: ");
-                scanf("%f", &p->clock_basico_ghz);
-                printf("Digite o clock maximo: ");
-                scanf("%f", &p->clock_maximo_ghz);
-                printf("Digite a TDP: ");
-                scanf("%d", &p->tdp_watts);
-                printf("Digite se o processador possui video integrado( s para sim ou n para nao): ");
-                scanf(" %c", &p->video_integrado);
+        // Avisa que terminou a rodada
+        pthread_mutex_lock(&catalogo->trava_pool);
+        catalogo->finalizados++;
+        if(catalogo->finalizados == catalogo->num_trabalhadores){
+            pthread_cond_signal(&catalogo->rodada_concluida);
+        }
+    }
+    pthread_mutex_unlock(&catalogo->trava_pool);
 
-                inserir_elemento_inicio(lista, p);
-                break;
-            case 4:
-                listar_elementos(lista);
-                break;
-            case 5:
-                printf("\n------ REMOVER ITEM DA LISTA -------\n\n");
-                printf("Digite a posicao do item a ser removido: ");
-                scanf("%d", &posicao);
-                remover_elemento(lista, posicao);
-                break;
-            case 6:
-                printf("\n------ ALTERAR ITEM DA LISTA -------\n\n");
-                printf("Digite o modelo do processador: ");
-                scanf(" %[^\n]", p->modelo);
-                printf("Digite o novo numero de cores: ");
-                scanf("%d", &p->numero_cores);
-                printf("Digite o novo numero de threads: ");
-                scanf("%d", &p->numero_threads);
-                printf("Digite a nova litografia: ");
-                scanf("%d", &p->litografia_nm);
-                printf("Digite o novo clock basico: ");
-                scanf("%f", &p->clock_basico_ghz);
-                printf("Digite o novo clock maximo: ");
-                scanf("%f", &p->clock_maximo_ghz);
-                printf("Digite a nova TDP: ");
-                scanf("%d", &p->tdp_watts);
-                printf("Digite se o processador possui video integrado( s para sim ou n para nao): ");
-                scanf(" %c", &p->video_integrado);
-                printf("Digite a posicao do item a ser alterado: ");
-                scanf("%d", &posicao);
+    return NULL;
+}
 
-                atualizar(lista, p, posicao);
-                break;
-            case 7:
-                printf("\n------ PESQUISAR ITEM -------\n\n");
-                printf("Digite a posicao do item a ser pesquisado: ");
-                scanf("%d", &posicao);
+/* Nome: liberar_catalogo
+ * Parametros:
+ *    - Catalogo *catalogo: o ponteiro que contm o endereo do catlogo;
+ *    - int num_particoes: a quantidade de parties j criadas que devem ser liberadas.
+ * Retorno: void
+ * Descrio: Funo responsvel por encerrar os trabalhadores, destruir as travas, liberar as parties criadas e a memria
+ *            do catlogo, sem exibir mensagens.  usada tanto para desfazer um catlogo criado pela metade quanto para excluir
+ *            um catlogo completo.
+ */
+void liberar_catalogo(Catalogo *catalogo, int num_particoes){
 
-                buscar_elemento(lista, posicao);
-                break;
-            case 8:
-                printf("Itens cadastrados: %d\n", tamanho(lista));
-                break;
-            case 9:
-                excluir_lista(lista);
-                break;
-            case 10:
-                carregar_dados(lista);
-                break;
-            case 11:
-                salvar_dados(lista);
-                break;
-            case 0:
-                printf("Programa encerrado!");
+    int i;
 
-                // Libera a memria alocada para as estruturas
-                free(p);
-                free(lista->itens);
-                free(lista);
-                break;
-            default:
-                printf("\nOpcao invalida\n");
+    // Encerra os trabalhadores e aguarda o trmino de cada um
+    pthread_mutex_lock(&catalogo->trava_pool);
+    catalogo->encerrar = 1;
+    pthread_cond_broadcast(&catalogo->tem_trabalho);
+    pthread_mutex_unlock(&catalogo->trava_pool);
+
+    for(i = 0; i < catalogo->num_trabalhadores; i++){
+        pthread_join(catalogo->trabalhadores[i], NULL);
+    }
+    free(catalogo->trabalhadores);
+
+    pthread_mutex_destroy(&catalogo->trava_execucao);
+    pthread_mutex_destroy(&catalogo->trava_pool);
+    pthread_cond_destroy(&catalogo->tem_trabalho);
+    pthread_cond_destroy(&catalogo->rodada_concluida);
+
+    // Libera a memria de cada partio e destri a sua trava
+    for(i = 0; i < num_particoes; i++){
+        pthread_mutex_destroy(&catalogo->travas[i]);
+        free(catalogo->particoes[i]->itens);
+        free(catalogo->particoes[i]);
+    }
+
+    // Libera a memria alocada para o catlogo
+    free(catalogo->particoes);
+    free(catalogo->travas);
+    free(catalogo);
+}
+
+/* Nome: numero_nucleos
+ * Parametros: void
+ * Retorno: int: a quantidade de ncleos disponveis, no mnimo 1.
+ * Descrio: Funo responsvel por consultar quantos ncleos esto disponveis para dimensionar o catlogo.
+ */
+int numero_nucleos(){
+
+    long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+
+    // Considera um nico ncleo caso a consulta falhe
+    if(nucleos < 1){
+        return 1;
+    }
+
+    return (int) nucleos;
+}
+
+/* Nome: criar_catalogo
+ * Parametros:
+ *    - int num_particoes: a quantidade de listas (parties) que compem o catlogo;
+ *    - int num_trabalhadores: a quantidade de threads trabalhadoras, alm da thread que chama as operaes paralelas.
+ * Retorno:
+ *    - NULL: caso a quantidade de parties ou de trabalhadores seja invlida ou a alocao de memria falhe;
+ *    - Catalogo *catalogo: retorna um ponteiro para o catlogo criado.
+ * Descrio: Funo responsvel por criar um catlogo dividido em vrias listas, cada uma protegida pela sua prpria trava,
+ *            permitindo que inseres em parties diferentes ocorram ao mesmo tempo. Os trabalhadores so criados uma nica
+ *            vez e reaproveitados por todas as operaes paralelas. Caso no seja possvel criar algum trabalhador, o catlogo
+ *            funciona com os que foram criados, e a thread que chama a operao processa o restante.
+ */
+Catalogo* criar_catalogo(int num_particoes, int num_trabalhadores){
+
+    int i;
+
+    // Aborta a funo caso a quantidade de parties ou de trabalhadores seja invlida
+    if(num_particoes < 1 || num_trabalhadores < 0){
+        printf("Quantidade de particoes invalida\n");
+        return NULL;
+    }
+
+    // Requisita alocao de memria para o catlogo
+    Catalogo *catalogo = (Catalogo*) malloc(sizeof(Catalogo));
+
+    // Aborta a funo caso a alocao de memria falhe
+    if(catalogo == NULL){
+        printf("No existe espao suficiente para alocao\n");
+        return NULL;
+    }
+
+    // Inicializa o controle dos trabalhadores, que ainda no foram criados
+    catalogo->num_trabalhadores = 0;
+    catalogo->trabalhadores = NULL;
+    catalogo->tarefas = NULL;
+    catalogo->funcao = NULL;
+    catalogo->total_tarefas = 0;
+    atomic_init(&catalogo->proxima, 0);
+    catalogo->finalizados = 0;
+    catalogo->geracao = 0;
+    catalogo->encerrar = 0;
+    pthread_mutex_init(&catalogo->trava_execucao, NULL);
+    pthread_mutex_init(&catalogo->trava_pool, NULL);
+    pthread_cond_init(&catalogo->tem_trabalho, NULL);
+    pthread_cond_init(&catalogo->rodada_concluida, NULL);
+
+    // Requisita alocao de memria para o vetor de parties e para o vetor de travas
+    catalogo->particoes = (Lista**) malloc(sizeof(Lista*) * num_particoes);
+    catalogo->travas = (pthread_mutex_t*) malloc(sizeof(pthread_mutex_t) * num_particoes);
+
+    // Aborta a funo caso a alocao de memria falhe
+    if(catalogo->particoes == NULL || catalogo->travas == NULL){
+        printf("No existe espao suficiente para alocao\n");
+        liberar_catalogo(catalogo, 0);
+        return NULL;
+    }
+
+    // Cria cada partio e inicializa a sua trava
+    for(i = 0; i < num_particoes; i++){
+        catalogo->particoes[i] = criar_lista();
+
+        // Desfaz as parties j criadas caso a alocao de memria falhe
+        if(catalogo->particoes[i] == NULL){
+            liberar_catalogo(catalogo, i);
+            return NULL;
         }
 
-    // No encerra o programa at que o usurio solicite
-    }while(opcao != 0);
+        pthread_mutex_init(&catalogo->travas[i], NULL);
+    }
 
-    return 0;
+    // Inicializa o contador de parties
+    catalogo->num_particoes = num_particoes;
+
+    // Cria os trabalhadores, que aguardam a primeira rodada de tarefas
+    if(num_trabalhadores > 0){
+        catalogo->trabalhadores = (pthread_t*) malloc(sizeof(pthread_t) * num_trabalhadores);
+    }
+    for(i = 0; catalogo->trabalhadores != NULL && i < num_trabalhadores; i++){
+        if(pthread_create(&catalogo->trabalhadores[i], NULL, trabalhador_pool, catalogo) != 0){
+            break;
+        }
+        catalogo->num_trabalhadores++;
+    }
+
+    return catalogo;
+}
+
+/* Nome: particao_modelo
+ * Parametros:
+ *    - Catalogo *catalogo: o ponteiro que contm o endereo do catlogo;
+ *    - char *modelo: o modelo do processador.
+ * Retorno: int: o ndice da partio responsvel pelo modelo informado.
+ * Descrio: Funo responsvel por distribuir os modelos entre as parties a partir de um hash do nome do modelo.
+ */
+int particao_modelo(Catalogo *catalogo, char *modelo){
+
+    unsigned long hash = 5381;
+    int i;
+
+    // Calcula o hash (djb2) dos caracteres do modelo
+    for(i = 0; i < TAMANHO_MODELO && modelo[i] != '\0'; i++){
+        hash = hash * 33 + (unsigned char) modelo[i];
+    }
+
+    return (int) (hash % catalogo->num_particoes);
+}
+
+/* Nome: travar_catalogo
+ * Parametros: Catalogo *catalogo: o ponteiro que contm o endereo do catlogo.
+ * Retorno: void
+ * Descrio: Funo responsvel por travar todas as parties, sempre na mesma ordem para evitar deadlock,
+ *            garantindo uma viso consistente das posies durante as operaes posicionais.
+ */
+void travar_catalogo(Catalogo *catalogo){
+
+    int i;
+
+    for(i = 0; i < catalogo->num_particoes; i++){
+        pthread_mutex_lock(&catalogo->travas[i]);
+    }
 }
+
+/* Nome: destravar_catalogo
+ * Parametros: Catalogo *catalogo: o ponteiro que contm o endereo do catlogo.
+ * Retorno: void
+ * Descrio: Funo responsvel por liberar as travas de todas as parties.
+ */
+void destravar_catalogo(Catalogo *catalogo){
+
+    int i;
+
+    for(i = catalogo->num_particoes - 1; i >= 0; i--){
+        pthread_mutex_unlock(&catalogo->travas[i]);
+    }
+}
+
+/* Nome: localizar_posicao
+ * Parametros:
+ *    - Catalogo *catalogo: o ponteiro que contm o endereo do catlogo;
+ *    - int pos: a posio global do item no catlogo;
+ *    - int *pos_local: recebe a posio do item dentro da partio encontrada.
+ * Retorno:
+ *    - -1: caso a posio seja invlida;
+ *    - int: o ndice da partio que contm a posio indicada.
+ * Descrio: Funo responsvel por converter uma posio global em partio e posio local. Deve ser chamada com o catlogo travado.
+ */
+int localizar_posicao(Catalogo *catalogo, int pos, int *pos_local){
+
+    int i;
+
+    if(pos < 1){
+        return -1;
+    }
+
+    // Percorre as parties descontando a quantidade de itens de cada uma
+    for(i = 0; i < catalogo->num_particoes; i++){
+        if(pos <= catalogo->particoes[i]->id){
+            *pos_local = pos;
+            return i;
+        }
+        pos -= catalogo->particoes[i]->id;
+    }
+
+    return -1;
+}
+
+/* Nome: anexar_elemento
+ * Parametros:
+ *    - Lista *lista: o ponteiro que contm o endereo da partio;
+ *    - Processador *processador: o ponteiro que contm o endereo do processador.
+ * Retorno:
+ *    - 0: caso no seja possvel aumentar o vetor de itens;
+ *    - 1: caso a insero seja bem-sucedida.
+ * Descrio: Funo responsvel por inserir um processador no fim de uma partio do catlogo, dobrando a capacidade
+ *            do vetor de itens quando ele estiver cheio. Diferente de inserir_elemento, a partio no tem limite fixo
+ *            de itens: o catlogo s recusa inseres quando falta memria.
+ */
+int anexar_elemento(Lista *lista, Processador *processador){
+
+    Processador *itens;
+
+    // Dobra a capacidade do vetor de itens caso ele esteja cheio
+    if(lista->id >= lista->capacidade){
+        itens = (Processador*) realloc(lista->itens, sizeof(Processador) * lista->capacidade * 2);
+
+        // Aborta a funo caso a alocao de memria falhe, mantendo o vetor anterior
+        if(itens == NULL){
+            return 0;
+        }
+
+        lista->itens = itens;
+        lista->capacidade *= 2;
+    }
+
+    // Insere o processador no fim do vetor de itens e atualiza o contador
+    lista->itens[lista->id] = *processador;
+    lista->id++;
+
+    return 1;
+}
+
+/* Nome: inserir_catalogo
+ * Parametros:
+ *    - Catalogo *catalogo: o ponteiro que contm o endereo do catlogo;
+ *    - Processador *processador: o ponteiro que contm o endereo do processador.
+ * Retorno:
+ *    - 0: caso o catlogo no exista ou no exista memria para aumentar a partio do modelo;
+ *    - 1: caso a insero seja bem-sucedida.
+ * Descrio: Funo responsvel por inserir um processador na partio correspondente ao seu modelo, travando apenas essa partio.
+ *            As parties crescem conforme necessrio, ento o catlogo no fica cheio mesmo com modelos mal distribudos.
+ */
+int inserir_catalogo(Catalogo *catalogo, Processador *processador){
+
+    int particao, resultado;
+
+    // Aborta a funo caso o catlogo no exista
+    if(catalogo == NULL){
+        printf("\nCatalogo nao inicializado\n");
+        return 0;
+    }
+
+    particao = particao_modelo(catalogo, processador->modelo);
+
+    // Insere o processador apenas com a trava da sua partio
+    pthread_mutex_lock(&catalogo->travas[particao]);
+    resultado = anexar_elemento(catalogo->particoes[particao], processador);
+    pthread_mutex_unlock(&catalogo->travas[particao]);
+
+    if(resultado){
+        printf("\nItem inserido!\n");
+    } else {
+        printf("No existe espao suficiente para alocao\n");
+    }
+
+    return resultado;
+}
+
+/* Nome: remover_catalogo
+ * Parametros:
+ *    - Catalogo *catalogo: o ponteiro que contm o endereo do catlogo;
+ *    - int pos: a posio global do item a ser removido.
+ * Retorno:
+ *    - 0: caso o catlogo no exista ou a posio seja invlida;
+ *    - 1: caso a remoo seja bem-sucedida.
+ * Descrio: Funo responsvel por remover um processador do catlogo a partir da sua posio global.
+ */
+int remover_catalogo(Catalogo *catalogo, int pos){
+
+    int particao, pos_local, resultado = 0;
+
+    // Aborta a funo caso o catlogo no exista
+    if(catalogo == NULL){
+        printf("Catalogo nao inicializado\n");
+        return 0;
+    }
+
+    travar_catalogo(catalogo);
+
+    // Remove o item da partio que contm a posio indicada
+    particao = localizar_posicao(catalogo, pos, &pos_local);
+    if(particao >= 0){
+        resultado = remover_elemento(catalogo->particoes[particao], pos_local);
+    } else {
+        printf("Posicao invalida\n");
+    }
+
+    destravar_catalogo(catalogo);
+
+    return resultado;
+}
+
+/* Nome: atualizar_catalogo
+ * Parametros:
+ *    - Catalogo *catalogo: o ponteiro que contm o endereo do catlogo;
+ *    - Processador *processador: o ponteiro que contm o endereo do processador;
+ *    - int pos: a posio global do item a ser atualizado.
+ * Retorno:
+ *    - 0: caso o catlogo no exista, a posio seja invlida ou no exista memria para mover o item;
+ *    - 1: caso a atualizao seja bem-sucedida.
+ * Descrio: Funo responsvel alterar um processador do catlogo a partir da sua posio global. Caso o novo modelo
+ *            pertena a outra partio, o item  movido para o fim dessa partio e passa a ocupar outra posio global.
+ */
+int atualizar_catalogo(Catalogo *catalogo, Processador *processador, int pos){
+
+    int particao, nova_particao, pos_local;
+    Lista *lista;
+
+    // Aborta a funo caso o catlogo no exista
+    if(catalogo == NULL){
+        printf("Catalogo nao inicializado\n");
+        return 0;
+    }
+
+    travar_catalogo(catalogo);
+
+    particao = localizar_posicao(catalogo, pos, &pos_local);
+
+    // Aborta a funo caso a posio seja invlida
+    if(particao < 0){
+        destravar_catalogo(catalogo);
+        printf("Posicao invalida\n");
+        return 0;
+    }
+
+    nova_particao = particao_modelo(catalogo, processador->modelo);
+    lista = catalogo->particoes[particao];
+
+    // Atualiza o processador na prpria partio quando o modelo continua na mesma partio
+    if(nova_particao == particao){
+        lista->itens[pos_local - 1] = *processador;
+
+    // Move o processador para a partio do novo modelo, inserindo antes de remover para no perder o item caso falte memria
+    } else {
+        if(!anexar_elemento(catalogo->particoes[nova_particao], processador)){
+            destravar_catalogo(catalogo);
+            printf("No existe espao suficiente para alocao\n");
+            return 0;
+        }
+
+        // Retira o item movido da partio antiga
+        retirar_item(lista, pos_local);
+    }
+
+    destravar_catalogo(catalogo);
+
+    printf("Item atualizado!\n");
+    return 1;
+}
+
+/* Nome: buscar_catalogo
+ * Parametros:
+ *    - Catalogo *catalogo: o ponteiro que contm o endereo do catlogo;
+ *    - int pos: a posio global do item a ser buscado.
+ * Retorno:
+ *    - 0: caso o catlogo no exista ou a posio seja invlida;
+ *    - 1: caso o item seja encontrado.
+ * Descrio: Funo responsvel por buscar e exibir um processador do catlogo a partir da sua posio global.
+ */
+int buscar_catalogo(Catalogo *catalogo, int pos){
+
+    int particao, pos_local;
+    Processador item;
+
+    // Aborta a funo caso o catlogo no exista
+    if(catalogo == NULL){
+        printf("Catalogo nao inicializado\n");
+        return 0;
+    }
+
+    travar_catalogo(catalogo);
+
+    particao = localizar_posicao(catalogo, pos, &pos_local);
+
+    // Aborta a funo caso a posio seja invlida
+    if(particao < 0){
+        destravar_catalogo(catalogo);
+        printf("Posicao invalida\n");
+        return 0;
+    }
+
+    // Copia o processador referente a posio indicada e libera as travas antes de exibir
+    item = catalogo->particoes[particao]->itens[pos_local - 1];
+
+    destravar_catalogo(catalogo);
+
+    printf("\nModelo %d: %s\n", pos, item.modelo);
+    printf("  Cores: %d\n", item.numero_cores);
+    printf("  Threads: %d\n", item.numero_threads);
+    printf("  Litografia: %d nm\n", item.litografia_nm);
+    printf("  Clock basico: %.2f GHz\n", item.clock_basico_ghz);
+    printf("  Clock Max.: %.2f GHz\n", item.clock_maximo_ghz);
+    printf("  TDP: %dW\n", item.tdp_watts);
+    printf("  Video Integrado: %c\n", item.video_integrado);
+
+    return 1;
+}
+
+/* Nome: buscar_catalogo_modelo
+ * Parametros:
+ *    - Catalogo *catalogo: o ponteiro que contm o endereo do catlogo;
+ *    - char *modelo: o modelo do processador a ser buscado.
+ * Retorno:
+ *    - 0: caso o catlogo no exista ou o modelo no seja encontrado;
+ *    - 1: caso o item seja encontrado.
+ * Descrio: Funo responsvel por buscar e exibir um processador pelo modelo, percorrendo apenas a partio correspondente.
+ */
+int buscar_catalogo_modelo(Catalogo *catalogo, char *modelo){
+
+    int particao, i, encontrado = 0;
+    Lista *lista;
+    Processador item;
+
+    // Aborta a funo caso o catlogo no exista
+    if(catalogo == NULL){
+        printf("Catalogo nao inicializado\n");
+        return 0;
+    }
+
+    particao = particao_modelo(catalogo, modelo);
+    lista = catalogo->particoes[particao];
+
+    pthread_mutex_lock(&catalogo->travas[particao]);
+
+    // Percorre a partio do modelo procurando o processador e copia o item encontrado
+    for(i = 0; i < lista->id; i++){
+        if(strncmp(lista->itens[i].modelo, modelo, TAMANHO_MODELO) == 0){
+            item = lista->itens[i];
+            encontrado = 1;
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&catalogo->travas[particao]);
+
+    // Exibe o processador depois de liberar a trava
+    if(!encontrado){
+        printf("Modelo nao encontrado\n");
+        return 0;
+    }
+
+    printf("\nModelo: %s\n", item.modelo);
+    printf("  Cores: %d\n", item.numero_cores);
+    printf("  Threads: %d\n", item.numero_threads);
+    printf("  Litografia: %d nm\n", item.litografia_nm);
+    printf("  Clock basico: %.2f GHz\n", item.clock_basico_ghz);
+    printf("  Clock Max.: %.2f GHz\n", item.clock_maximo_ghz);
+    printf("  TDP: %dW\n", item.tdp_watts);
+    printf("  Video Integrado: %c\n", item.video_integrado);
+
+    return encontrado;
+}
+
+/* Nome: tamanho_catalogo
+ * Parametro: Catalogo *catalogo: o ponteiro que contm o endereo do catlogo.
+ * Retorno:
+ *    - 0: caso o catlogo no exista;
+ *    - int: a soma da quantidade de itens de todas as parties.
+ * Descrio: Funo responsvel por retornar a quantidade de itens no catlogo.
+ */
+int tamanho_catalogo(Catalogo *catalogo){
+
+    int i, total = 0;
+
+    // Aborta a funo caso o catlogo no exista
+    if(catalogo == NULL){
+        printf("Catalogo nao inicializado\n");
+        return 0;
+    }
+
+    // Soma a quantidade de itens de cada partio
+    for(i = 0; i < catalogo->num_particoes; i++){
+        pthread_mutex_lock(&catalogo->travas[i]);
+        total += catalogo->particoes[i]->id;
+        pthread_mutex_unlock(&catalogo->travas[i]);
+    }
+
+    return total;
+}
+
+/* Nome: executar_em_paralelo
+ * Parametros:
+ *    - Catalogo *catalogo: o ponteiro que contm o endereo do catlogo;
+ *    - Tarefa *tarefas: o vetor de tarefas, uma para cada partio;
+ *    - void *(*funcao)(void *): a funo executada sobre cada partio.
+ * Retorno: void
+ * Descrio: Funo responsvel por executar a mesma funo sobre todas as parties com os trabalhadores do catlogo
+ *            e aguardar o trmino de todas. A thread atual tambm processa tarefas, ento o catlogo funciona mesmo sem
+ *            trabalhadores. Operaes paralelas simultneas sobre o mesmo catlogo so executadas uma de cada vez.
+ */
+void executar_em_paralelo(Catalogo *catalogo, Tarefa *tarefas, void *(*funcao)(void *)){
+
+    int i;
+
+    pthread_mutex_lock(&catalogo->trava_execucao);
+
+    for(i = 0; i < catalogo->num_particoes; i++){
+        tarefas[i].lista = catalogo->particoes[i];
+        tarefas[i].trava = &catalogo->travas[i];
+        tarefas[i].indice = i;
+    }
+
+    // Publica a nova rodada e acorda os trabalhadores
+    pthread_mutex_lock(&catalogo->trava_pool);
+    catalogo->tarefas = tarefas;
+    catalogo->funcao = funcao;
+    catalogo->total_tarefas = catalogo->num_particoes;
+    atomic_store(&catalogo->proxima, 0);
+    catalogo->finalizados = 0;
+    catalogo->geracao++;
+    pthread_cond_broadcast(&catalogo->tem_trabalho);
+    pthread_mutex_unlock(&catalogo->trava_pool);
+
+    // A thread atual tambm reivindica tarefas enquanto houver
+    processar_tarefas(catalogo);
+
+    // Aguarda todos os trabalhadores terminarem a rodada antes de liberar o vetor de tarefas para uma nova rodada
+    pthread_mutex_lock(&catalogo->trava_pool);
+    while(catalogo->finalizados < catalogo->num_trabalhadores){
+        pthread_cond_wait(&catalogo->rodada_concluida, &catalogo->trava_pool);
+    }
+    pthread_mutex_unlock(&catalogo->trava_pool);
+
+    pthread_mutex_unlock(&catalogo->trava_execucao);
+}
+
+/* Nome: filtrar_particao
+ * Parametro: void *arg: o ponteiro para a Tarefa da partio.
+ * Retorno: NULL
+ * Descrio: Funo executada por cada thread para contar os processadores da partio com o nmero mnimo de cores.
+ */
+void* filtrar_particao(void *arg){
+
+    Tarefa *tarefa = (Tarefa*) arg;
+    int i;
+
+    tarefa->resultado = 0;
+
+    pthread_mutex_lock(tarefa->trava);
+    for(i = 0; i < tarefa->lista->id; i++){
+        if(tarefa->lista->itens[i].numero_cores >= tarefa->min_cores){
+            tarefa->resultado++;
+        }
+    }
+    pthread_mutex_unlock(tarefa->trava);
+
+    return NULL;
+}
+
+/* Nome: filtrar_catalogo
+ * Parametros:
+ *    - Catalogo *catalogo: o ponteiro que contm o endereo do catlogo;
+ *    - int min_cores: o nmero mnimo de cores dos processadores procurados.
+ * Retorno:
+ *    - 0: caso o catlogo no exista ou nenhum processador atenda ao filtro;
+ *    - int: a quantidade de processadores com pelo menos min_cores cores.
+ * Descrio: Funo responsvel por percorrer todas as parties em paralelo e contar os processadores que atendem ao filtro.
+ */
+int filtrar_catalogo(Catalogo *catalogo, int min_cores){
+
+    int i, total = 0;
+    Tarefa *tarefas;
+
+    // Aborta a funo caso o catlogo no exista
+    if(catalogo == NULL){
+        printf("Catalogo nao inicializado\n");
+        return 0;
+    }
+
+    tarefas = (Tarefa*) calloc(catalogo->num_particoes, sizeof(Tarefa));
+
+    // Aborta a funo caso a alocao de memria falhe
+    if(tarefas == NULL){
+        printf("No existe espao suficiente para alocao\n");
+        return 0;
+    }
+
+    for(i = 0; i < catalogo->num_particoes; i++){
+        tarefas[i].min_cores = min_cores;
+    }
+
+    executar_em_paralelo(catalogo, tarefas, filtrar_particao);
+
+    // Soma o resultado de cada partio
+    for(i = 0; i < catalogo->num_particoes; i++){
+        total += tarefas[i].resultado;
+    }
+
+    free(tarefas);
+
+    return total;
+}
+
+/* Nome: salvar_particao
+ * Parametro: void *arg: o ponteiro para a Tarefa da partio.
+ * Retorno: NULL
+ * Descrio: Funo executada por cada thread para escrever os itens da partio no seu prprio arquivo (<prefixo>_<indice>.txt),
+ *            numerando cada item pela sua posio global no catlogo. Escreve a cpia dos itens feita por salvar_catalogo,
+ *            ento no precisa da trava da partio.
+ */
+void* salvar_particao(void *arg){
+
+    Tarefa *tarefa = (Tarefa*) arg;
+    char nome[256];
+    int i;
+
+    snprintf(nome, sizeof(nome), "%s_%d.txt", tarefa->prefixo, tarefa->indice);
+
+    // Tenta abrir o arquivo da partio em modo escrita
+    FILE *arquivo = fopen(nome, "w");
+
+    // Aborta a funo caso o arquivo no exista
+    if(arquivo == NULL){
+        tarefa->resultado = 0;
+        return NULL;
+    }
+
+    // Percorre a cpia dos itens e escreve cada item no arquivo
+    for(i = 0; i < tarefa->quantidade; i++){
+        fprintf(arquivo, "Modelo %d: %s\n", tarefa->inicio + i + 1, tarefa->itens[i].modelo);
+        fprintf(arquivo, "  Cores: %d\n", tarefa->itens[i].numero_cores);
+        fprintf(arquivo, "  Threads: %d\n", tarefa->itens[i].numero_threads);
+        fprintf(arquivo, "  Litografia: %d nm\n", tarefa->itens[i].litografia_nm);
+        fprintf(arquivo, "  Clock basico: %.2f\n", tarefa->itens[i].clock_basico_ghz);
+        fprintf(arquivo, "  Clock maximo: %.2f\n", tarefa->itens[i].clock_maximo_ghz);
+        fprintf(arquivo, "  TDP: %dW\n", tarefa->itens[i].tdp_watts);
+        fprintf(arquivo, "  Video integrado: %c\n", tarefa->itens[i].video_integrado);
+        fprintf(arquivo, "- - - - - - - - - - - - - - -\n");
+    }
+
+    // Fecha o arquivo
+    fclose(arquivo);
+
+    tarefa->resultado = 1;
+    return NULL;
+}
+
+/* Nome: salvar_catalogo
+ * Parametros:
+ *    - Catalogo *catalogo: o ponteiro que contm o endereo do catlogo;
+ *    - char *prefixo: o prefixo dos arquivos das parties.
+ * Retorno:
+ *  - 0: caso o catlogo no exista ou algum arquivo no possa ser escrito;
+ *  - 1: caso os dados de todas as parties sejam escritos com sucesso.
+ * Descrio: Funo responsvel por salvar as parties em paralelo, cada uma no seu prprio arquivo (<prefixo>_<indice>.txt).
+ */
+int salvar_catalogo(Catalogo *catalogo, char *prefixo){
+
+    int i, resultado = 1;
+    Tarefa *tarefas;
+
+    // Aborta a funo caso o catlogo no exista
+    if(catalogo == NULL){
+        printf("Catalogo nao inicializado\n");
+        return 0;
+    }
+
+    tarefas = (Tarefa*) calloc(catalogo->num_particoes, sizeof(Tarefa));
+
+    // Aborta a funo caso a alocao de memria falhe
+    if(tarefas == NULL){
+        printf("No existe espao suficiente para alocao\n");
+        return 0;
+    }
+
+    // Trava todas as parties apenas para copiar os itens, para que as posies gravadas sejam as mesmas aceitas
+    // por buscar_catalogo e remover_catalogo sem bloquear as inseres durante a escrita dos arquivos
+    travar_catalogo(catalogo);
+
+    for(i = 0; i < catalogo->num_particoes; i++){
+
+        // Calcula a posio global em que cada partio comea
+        if(i > 0){
+            tarefas[i].inicio = tarefas[i - 1].inicio + tarefas[i - 1].quantidade;
+        }
+
+        tarefas[i].prefixo = prefixo;
+        tarefas[i].quantidade = catalogo->particoes[i]->id;
+        tarefas[i].itens = (Processador*) malloc(sizeof(Processador) * (tarefas[i].quantidade > 0 ? tarefas[i].quantidade : 1));
+
+        // Aborta a funo caso a alocao de memria falhe, liberando as cpias j feitas
+        if(tarefas[i].itens == NULL){
+            destravar_catalogo(catalogo);
+            while(--i >= 0){
+                free(tarefas[i].itens);
+            }
+            free(tarefas);
+            printf("No existe espao suficiente para alocao\n");
+            return 0;
+        }
+
+        memcpy(tarefas[i].itens, catalogo->particoes[i]->itens, sizeof(Processador) * tarefas[i].quantidade);
+    }
+
+    destravar_catalogo(catalogo);
+
+    // Escreve os arquivos em paralelo a partir das cpias
+    executar_em_paralelo(catalogo, tarefas, salvar_particao);
+
+    // Verifica se todas as parties foram salvas
+    for(i = 0; i < catalogo->num_particoes; i++){
+        if(!tarefas[i].resultado){
+            printf("Nao foi possivel salvar a particao %d.\n", i);
+            resultado = 0;
+        }
+        free(tarefas[i].itens);
+    }
+
+    free(tarefas);
+
+    if(resultado){
+        printf("Dados salvos com sucesso!\n");
+    }
+    return resultado;
+}
+
+/* Nome: carregar_particao
+ * Parametro: void *arg: o ponteiro para a Tarefa da partio.
+ * Retorno: NULL
+ * Descrio: Funo executada por cada thread para ler o arquivo da partio para um buffer em memria. O resultado da
+ *            leitura fica em tarefa->resultado: 1 em caso de sucesso, 0 caso o arquivo no exista, -1 caso a alocao de
+ *            memria falhe e -2 caso ocorra um erro de leitura.
+ */
+void* carregar_particao(void *arg){
+
+    Tarefa *tarefa = (Tarefa*) arg;
+    char nome[256];
+    long tamanho_arquivo;
+
+    tarefa->conteudo = NULL;
+    tarefa->resultado = 0;
+    snprintf(nome, sizeof(nome), "%s_%d.txt", tarefa->prefixo, tarefa->indice);
+
+    // Tenta abrir o arquivo da partio em modo leitura
+    FILE *arquivo = fopen(nome, "r");
+
+    // Aborta a funo caso o arquivo no exista
+    if(arquivo == NULL){
+        return NULL;
+    }
+
+    // Descobre o tamanho do arquivo
+    if(fseek(arquivo, 0, SEEK_END) != 0 || (tamanho_arquivo = ftell(arquivo)) < 0){
+        fclose(arquivo);
+        tarefa->resultado = -2;
+        return NULL;
+    }
+    rewind(arquivo);
+
+    // Aborta a funo caso a alocao de memria falhe
+    tarefa->conteudo = (char*) malloc(tamanho_arquivo + 1);
+    if(tarefa->conteudo == NULL){
+        fclose(arquivo);
+        tarefa->resultado = -1;
+        return NULL;
+    }
+
+    // L todo o contedo de uma vez e aborta a funo caso ocorra um erro de leitura
+    tarefa->conteudo[fread(tarefa->conteudo, 1, tamanho_arquivo, arquivo)] = '\0';
+    if(ferror(arquivo)){
+        free(tarefa->conteudo);
+        tarefa->conteudo = NULL;
+        fclose(arquivo);
+        tarefa->resultado = -2;
+        return NULL;
+    }
+
+    tarefa->resultado = 1;
+
+    // Fecha o arquivo
+    fclose(arquivo);
+
+    return NULL;
+}
+
+/* Nome: carregar_catalogo
+ * Parametros:
+ *    - Catalogo *catalogo: o ponteiro que contm o endereo do catlogo;
+ *    - char *prefixo: o prefixo dos arquivos das parties.
+ * Retorno: void
+ * Descrio: Funo responsvel por ler os arquivos das parties (<prefixo>_<indice>.txt) em paralelo e exibir o contedo
+ *            no terminal, na ordem das parties.
+ */
+void carregar_catalogo(Catalogo *catalogo, char *prefixo){
+
+    int i;
+    Tarefa *tarefas;
+
+    // Aborta a funo caso o catlogo no exista
+    if(catalogo == NULL){
+        printf("Catalogo nao inicializado\n");
+        return;
+    }
+
+    tarefas = (Tarefa*) calloc(catalogo->num_particoes, sizeof(Tarefa));
+
+    // Aborta a funo caso a alocao de memria falhe
+    if(tarefas == NULL){
+        printf("No existe espao suficiente para alocao\n");
+        return;
+    }
+
+    for(i = 0; i < catalogo->num_particoes; i++){
+        tarefas[i].prefixo = prefixo;
+    }
+
+    executar_em_paralelo(catalogo, tarefas, carregar_particao);
+
+    // Exibe o contedo de cada partio na ordem, para no misturar as sadas das threads
+    for(i = 0; i < catalogo->num_particoes; i++){
+        if(tarefas[i].resultado == 0){
+            printf("O arquivo da particao %d nao existe.\n", i);
+            continue;
+        }
+        if(tarefas[i].resultado == -1){
+            printf("No existe espao suficiente para carregar a particao %d.\n", i);
+            continue;
+        }
+        if(tarefas[i].resultado == -2){
+            printf("Erro ao ler o arquivo da particao %d.\n", i);
+            continue;
+        }
+        printf("%s", tarefas[i].conteudo);
+        free(tarefas[i].conteudo);
+    }
+
+    free(tarefas);
+
+    return;
+}
+
+/* Nome: excluir_catalogo
+ * Parametro: Catalogo *catalogo: o ponteiro que contm o endereo do catlogo.
+ * Retorno:
+ *    - NULL: caso o catlogo no exista ou caso o catlogo seja excluido com sucesso.
+ * Descrio: Funo responsvel por excluir todas as parties, destruir as travas e liberar a memria do catlogo.
+ */
+Catalogo* excluir_catalogo(Catalogo *catalogo){
+
+    // Aborta a funo caso o catlogo no exista
+    if(catalogo == NULL){
+        printf("Catalogo nao inicializado\n");
+        return NULL;
+    }
+
+    // Libera as parties, as travas e a memria do catlogo
+    liberar_catalogo(catalogo, catalogo->num_particoes);
+
+    printf("Catalogo excluido com sucesso!\n");
+    return NULL;
+}
+
+#ifdef TESTE
+
+/*Prefixo prprio dos arquivos da verificao, para no sobrescrever os arquivos salvos pelo programa*/
+#define PREFIXO_TESTE "teste_catalogo"
+
+/*Quantidade de parties do catlogo da verificao*/
+#define NUM_PARTICOES 4
+
+/*Quantidade de trabalhadores do catlogo da verificao*/
+#define TRABALHADORES_TESTE 3
+
+/*Contador de verificaes que falharam*/
+int falhas = 0;
+
+/*Registra e exibe o resultado de uma verificao*/
+#define VERIFICAR(condicao) \
+    do{ \
+        if(!(condicao)){ \
+            printf("FALHOU (linha %d): %s\n", __LINE__, #condicao); \
+            falhas++; \
+        } \
+    }while(0)
+
+/*Quantidade de threads e de itens por thread da verificao concorrente*/
+#define THREADS_TESTE 4
+#define ITENS_POR_THREAD 200
+
+/* Nome: inserir_e_filtrar
+ * Parametro: void *arg: o ponteiro para o Catalogo da verificao.
+ * Retorno: NULL
+ * Descrio: Funo executada por cada thread da verificao concorrente, alternando inseres e filtros paralelos.
+ */
+void* inserir_e_filtrar(void *arg){
+
+    Catalogo *catalogo = (Catalogo*) arg;
+    Processador p = {0};
+    int i;
+
+    for(i = 0; i < ITENS_POR_THREAD; i++){
+        sprintf(p.modelo, "t%lu_%d", (unsigned long) pthread_self() % 100000, i);
+        p.numero_cores = 2000;
+        inserir_catalogo(catalogo, &p);
+        filtrar_catalogo(catalogo, 2000);
+    }
+
+    return NULL;
+}
+
+/* Nome: main (verificao)
+ * Parametros: void
+ * Retorno:
+ *    - 0: caso todas as verificaes do catlogo passem;
+ *    - 1: caso alguma verificao falhe.
+ * Descrio: Exercita insero, remoo, alterao, pesquisa, filtro, gravao e leitura do catlogo.
+ */
+int main(){
+
+    Catalogo *catalogo = criar_catalogo(NUM_PARTICOES, TRABALHADORES_TESTE);
+    Processador p = {0};
+    FILE *arquivo;
+    char nome[32], linha[256];
+    int i, numero, total_arquivos = 0, soma_posicoes = 0;
+    pthread_t threads[THREADS_TESTE];
+
+    VERIFICAR(catalogo != NULL);
+
+    // Insere mais itens do que cabem em NUM_PARTICOES listas de TAMANHO itens
+    for(i = 0; i < NUM_PARTICOES * TAMANHO * 3; i++){
+        sprintf(p.modelo, "cpu%d", i);
+        p.numero_cores = i;
+        p.video_integrado = 's';
+        VERIFICAR(inserir_catalogo(catalogo, &p) == 1);
+    }
+    VERIFICAR(tamanho_catalogo(catalogo) == NUM_PARTICOES * TAMANHO * 3);
+
+    // Filtra em paralelo pelo nmero mnimo de cores
+    VERIFICAR(filtrar_catalogo(catalogo, 10) == NUM_PARTICOES * TAMANHO * 3 - 10);
+    VERIFICAR(filtrar_catalogo(catalogo, 1000) == 0);
+
+    // Pesquisa pelo modelo e pela posio
+    VERIFICAR(buscar_catalogo_modelo(catalogo, "cpu7") == 1);
+    VERIFICAR(buscar_catalogo_modelo(catalogo, "inexistente") == 0);
+    VERIFICAR(buscar_catalogo(catalogo, 1) == 1);
+    VERIFICAR(buscar_catalogo(catalogo, tamanho_catalogo(catalogo)) == 1);
+    VERIFICAR(buscar_catalogo(catalogo, 0) == 0);
+    VERIFICAR(buscar_catalogo(catalogo, tamanho_catalogo(catalogo) + 1) == 0);
+
+    // Altera o primeiro item para um novo modelo, que deve continuar localizvel pelo modelo
+    sprintf(p.modelo, "novo");
+    p.numero_cores = 1000;
+    VERIFICAR(atualizar_catalogo(catalogo, &p, 1) == 1);
+    VERIFICAR(buscar_catalogo_modelo(catalogo, "novo") == 1);
+    VERIFICAR(filtrar_catalogo(catalogo, 1000) == 1);
+    VERIFICAR(tamanho_catalogo(catalogo) == NUM_PARTICOES * TAMANHO * 3);
+    VERIFICAR(atualizar_catalogo(catalogo, &p, 0) == 0);
+
+    // Remove o primeiro item e rejeita posies invlidas
+    VERIFICAR(remover_catalogo(catalogo, 1) == 1);
+    VERIFICAR(tamanho_catalogo(catalogo) == NUM_PARTICOES * TAMANHO * 3 - 1);
+    VERIFICAR(remover_catalogo(catalogo, 0) == 0);
+    VERIFICAR(remover_catalogo(catalogo, tamanho_catalogo(catalogo) + 1) == 0);
+
+    // Salva as parties e confere se os arquivos numeram os itens de 1 at o tamanho do catlogo
+    VERIFICAR(salvar_catalogo(catalogo, PREFIXO_TESTE) == 1);
+    for(i = 0; i < NUM_PARTICOES; i++){
+        sprintf(nome, "%s_%d.txt", PREFIXO_TESTE, i);
+        arquivo = fopen(nome, "r");
+        VERIFICAR(arquivo != NULL);
+        if(arquivo == NULL){
+            continue;
+        }
+        while(fgets(linha, sizeof(linha), arquivo) != NULL){
+            if(sscanf(linha, "Modelo %d:", &numero) == 1){
+                total_arquivos++;
+                soma_posicoes += numero;
+            }
+        }
+        fclose(arquivo);
+    }
+    VERIFICAR(total_arquivos == tamanho_catalogo(catalogo));
+    VERIFICAR(soma_posicoes == total_arquivos * (total_arquivos + 1) / 2);
+
+    // Executa vrias rodadas seguidas com os mesmos trabalhadores
+    for(i = 0; i < 1000; i++){
+        VERIFICAR(filtrar_catalogo(catalogo, 1000) == 1);
+    }
+
+    // Insere e filtra a partir de vrias threads ao mesmo tempo
+    numero = tamanho_catalogo(catalogo);
+    for(i = 0; i < THREADS_TESTE; i++){
+        VERIFICAR(pthread_create(&threads[i], NULL, inserir_e_filtrar, catalogo) == 0);
+    }
+    for(i = 0; i < THREADS_TESTE; i++){
+        pthread_join(threads[i], NULL);
+    }
+    VERIFICAR(tamanho_catalogo(catalogo) == numero + THREADS_TESTE * ITENS_POR_THREAD);
+    VERIFICAR(filtrar_catalogo(catalogo, 2000) == THREADS_TESTE * ITENS_POR_THREAD);
+
+    // L os arquivos salvos e remove os arquivos da verificao
+    carregar_catalogo(catalogo, PREFIXO_TESTE);
+    for(i = 0; i < NUM_PARTICOES; i++){
+        sprintf(nome, "%s_%d.txt", PREFIXO_TESTE, i);
+        remove(nome);
+    }
+
+    catalogo = excluir_catalogo(catalogo);
+
+    if(falhas > 0){
+        printf("\n%d verificacao(oes) falharam\n", falhas);
+        return 1;
+    }
+
+    printf("\nTodas as verificacoes passaram\n");
+    return 0;
+}
+
+#elif defined(BENCHMARK)
+
+/* Nome: agora_ms
+ * Parametros: void
+ * Retorno: double: o tempo atual do relgio monotnico em milissegundos.
+ * Descrio: Funo auxiliar do benchmark para medir a durao das varreduras.
+ */
+double agora_ms(){
+
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000.0 + t.tv_nsec / 1000000.0;
+}
+
+/* Nome: main (benchmark)
+ * Parametros:
+ *    - argv[1]: a quantidade total de itens do catlogo (padro: 4000000);
+ *    - argv[2]: o nmero mximo de threads de varredura (padro: o nmero de ncleos disponveis).
+ * Retorno:
+ *    - 0: caso o benchmark seja concludo;
+ *    - 1: caso no exista memria para montar o catlogo.
+ * Descrio: Mede o tempo de filtrar_catalogo sobre a mesma quantidade de itens com 1, 2, 4, ... threads de varredura
+ *            (a thread principal mais os trabalhadores do catlogo), usando a mesma configurao do programa:
+ *            PARTICOES_POR_NUCLEO parties por thread. Exibe a acelerao e a eficincia em relao a uma nica thread.
+ */
+int main(int argc, char *argv[]){
+
+    int itens = argc > 1 ? atoi(argv[1]) : 4000000;
+    int max_threads = argc > 2 ? atoi(argv[2]) : numero_nucleos();
+    int repeticoes = 10;
+    int threads, i, r, encontrados = 0;
+    double inicio, tempo, tempo_base = 0;
+    Catalogo *catalogo;
+    Processador p = {0};
+
+    if(max_threads < 1){
+        max_threads = 1;
+    }
+
+    printf("Itens: %d, nucleos disponiveis: %d, particoes por thread: %d\n\n", itens, numero_nucleos(), PARTICOES_POR_NUCLEO);
+    printf("Threads   Particoes   Tempo por varredura (ms)   Aceleracao   Eficiencia\n");
+
+    // Mede 1, 2, 4, ... threads e, por ltimo, o mximo pedido caso ele no seja uma potncia de 2
+    threads = 1;
+    while(1){
+        catalogo = criar_catalogo(threads * PARTICOES_POR_NUCLEO, threads - 1);
+        if(catalogo == NULL){
+            return 1;
+        }
+
+        // Monta o catlogo diretamente nas parties, sem as mensagens de inserir_catalogo
+        for(i = 0; i < itens; i++){
+            sprintf(p.modelo, "cpu%d", i);
+            p.numero_cores = i % 64;
+            if(!anexar_elemento(catalogo->particoes[particao_modelo(catalogo, p.modelo)], &p)){
+                printf("No existe espao suficiente para alocao\n");
+                liberar_catalogo(catalogo, catalogo->num_particoes);
+                return 1;
+            }
+        }
+
+        // Aquece as caches e mede a mdia de vrias varreduras paralelas
+        encontrados = filtrar_catalogo(catalogo, 32);
+        inicio = agora_ms();
+        for(r = 0; r < repeticoes; r++){
+            encontrados = filtrar_catalogo(catalogo, 32);
+        }
+        tempo = (agora_ms() - inicio) / repeticoes;
+
+        if(threads == 1){
+            tempo_base = tempo;
+        }
+
+        printf("%7d   %9d   %24.3f   %9.2fx   %9.0f%%\n", threads, catalogo->num_particoes, tempo,
+               tempo_base / tempo, 100.0 * tempo_base / tempo / threads);
+
+        // Libera as parties sem a mensagem de excluir_catalogo
+        liberar_catalogo(catalogo, catalogo->num_particoes);
+
+        if(threads == max_threads){
+            break;
+        }
+        threads = threads * 2 < max_threads ? threads * 2 : max_threads;
+    }
+
+    printf("\nItens com pelo menos 32 cores: %d\n", encontrados);
+    return 0;
+}
+
+#else
+
+int main() {
+
+    // Define um ponteiro do tipo Lista
+    Lista *lista = NULL;
+
+    // Define um ponteiro do tipo Catalogo
+    Catalogo *catalogo = NULL;
+
+    // Define um ponteiro do tipo Processador
+    Processador *p = (Processador*) malloc(sizeof(Processador));
+
+    // opcao: captura a navegao no menu do usuario. posicao: recebe a posicao no vetor de itens para alteraes. min_cores: recebe o filtro de cores
+    int opcao, posicao, min_cores;
+
+    // Cria a lista, o vetor de itens e configura o contador interno
+    lista = criar_lista();
+
+    // Cria o catlogo com parties e trabalhadores proporcionais aos ncleos disponveis
+    // (a thread do menu tambm processa tarefas, por isso um trabalhador a menos que o nmero de ncleos)
+    catalogo = criar_catalogo(numero_nucleos() * PARTICOES_POR_NUCLEO, numero_nucleos() - 1);
+
+    do{
+        // MENU PRINCIPAL
+        printf("------ CADASTRO DE ITENS -------\n");
+        printf("\nEscolha uma opcao: \n");
+        printf("  1 - Inserir um item no fim da lista\n");
+        printf("  2 - Inserir um item na posicao desejada\n");
+        printf("  3 - Inserir um item no inicio da lista\n");
+        printf("  4 - Exibir todos os itens cadastrados\n");
+        printf("  5 - Remover um item da lista\n");
+        printf("  6 - Alterar um item da lista\n");
+        printf("  7 - Pesquisar um item da lista\n");
+        printf("  8 - Exibir a quantidade de itens cadastrados\n");
+        printf("  9 - Excluir a lista\n");
+        printf(" 10 - Ler os itens do arquivo de cadastro\n");
+        printf(" 11 - Salvar os itens no arquivo de cadastro\n");
+        printf(" 12 - Inserir um item no catalogo\n");
+        printf(" 13 - Remover um item do catalogo\n");
+        printf(" 14 - Alterar um item do catalogo\n");
+        printf(" 15 - Pesquisar um item do catalogo pela posicao\n");
+        printf(" 16 - Pesquisar um item do catalogo pelo modelo\n");
+        printf(" 17 - Contar os itens do catalogo com um numero minimo de cores\n");
+        printf(" 18 - Exibir a quantidade de itens do catalogo\n");
+        printf(" 19 - Ler os itens dos arquivos do catalogo\n");
+        printf(" 20 - Salvar os itens nos arquivos do catalogo\n");
+        printf("  0 - Sair do programa\n\n");
+        printf("Opcao: ");
+        scanf("%d", &opcao);
+
+        // Captura a opo do usurio
+        switch(opcao){
+            case 1:
+                printf("\n------ INSERIR ITEM NO FIM DA LISTA -------\n\n");
+                printf("Digite o modelo do processador: ");
+                scanf(" %[^\n]", p->modelo);
+                printf("Digite o numero de cores: ");
+                scanf("%d", &p->numero_cores);
+                printf("Digite o numero de threads: ");
+                scanf("%d", &p->numero_threads);
+                printf("Digite a litografia: ");
+                scanf("%d", &p->litografia_nm);
+                printf("Digite o clock basico: ");
+                scanf("%f", &p->clock_basico_ghz);
+                printf("Digite o clock maximo: ");
+                scanf("%f", &p->clock_maximo_ghz);
+                printf("Digite a TDP: ");
+                scanf("%d", &p->tdp_watts);
+                printf("Digite se o processador possui video integrado( s para sim ou n para nao): ");
+                scanf(" %c", &p->video_integrado);
+
+                inserir_elemento(lista, p);
+                break;
+            case 2:
+                printf("\n------ INSERIR ITEM NA POSICAO DESEJADA -------\n\n");
+                printf("Digite o modelo do processador: ");
+                scanf(" %[^\n]", p->modelo);
+                printf("Digite o numero de cores: ");
+                scanf("%d", &p->numero_cores);
+                printf("Digite o numero de threads: ");
+                scanf("%d", &p->numero_threads);
+                printf("Digite a litografia: ");
+                scanf("%d", &p->litografia_nm);
+                printf("Digite o clock basico: ");
+                scanf("%f", &p->clock_basico_ghz);
+                printf("Digite o clock maximo: ");
+                scanf("%f", &p->clock_maximo_ghz);
+                printf("Digite a TDP: ");
+                scanf("%d", &p->tdp_watts);
+                printf("Digite se o processador possui video integrado( s para sim ou n para nao): ");
+                scanf(" %c", &p->video_integrado);
+                printf("Digite a posicao desejada: ");
+                scanf("%d", &posicao);
+
+                inserir_elemento_id(lista, p, posicao);
+                break;
+            case 3:
+                printf("\n------ INSERIR ITEM NO INICIO DA LISTA -------\n\n");
+                printf("Digite o modelo do processador: ");
+                scanf(" %[^\n]", p->modelo);
+                printf("Digite o numero de cores: ");
+                scanf("%d", &p->numero_cores);
+                printf("Digite o numero de threads: ");
+                scanf("%d", &p->numero_threads);
+                printf("Digite a litografia: ");
+                scanf("%d", &p->litografia_nm);
+                printf("Digite o clock basico: ");
+                scanf("%f", &p->clock_basico_ghz);
+                printf("Digite o clock maximo: ");
+                scanf("%f", &p->clock_maximo_ghz);
+                printf("Digite a TDP: ");
+                scanf("%d", &p->tdp_watts);
+                printf("Digite se o processador possui video integrado( s para sim ou n para nao): ");
+                scanf(" %c", &p->video_integrado);
+
+                inserir_elemento_inicio(lista, p);
+                break;
+            case 4:
+                listar_elementos(lista);
+                break;
+            case 5:
+                printf("\n------ REMOVER ITEM DA LISTA -------\n\n");
+                printf("Digite a posicao do item a ser removido: ");
+                scanf("%d", &posicao);
+                remover_elemento(lista, posicao);
+                break;
+            case 6:
+                printf("\n------ ALTERAR ITEM DA LISTA -------\n\n");
+                printf("Digite o modelo do processador: ");
+                scanf(" %[^\n]", p->modelo);
+                printf("Digite o novo numero de cores: ");
+                scanf("%d", &p->numero_cores);
+                printf("Digite o novo numero de threads: ");
+                scanf("%d", &p->numero_threads);
+                printf("Digite a nova litografia: ");
+                scanf("%d", &p->litografia_nm);
+                printf("Digite o novo clock basico: ");
+                scanf("%f", &p->clock_basico_ghz);
+                printf("Digite o novo clock maximo: ");
+                scanf("%f", &p->clock_maximo_ghz);
+                printf("Digite a nova TDP: ");
+                scanf("%d", &p->tdp_watts);
+                printf("Digite se o processador possui video integrado( s para sim ou n para nao): ");
+                scanf(" %c", &p->video_integrado);
+                printf("Digite a posicao do item a ser alterado: ");
+                scanf("%d", &posicao);
+
+                atualizar(lista, p, posicao);
+                break;
+            case 7:
+                printf("\n------ PESQUISAR ITEM -------\n\n");
+                printf("Digite a posicao do item a ser pesquisado: ");
+                scanf("%d", &posicao);
+
+                buscar_elemento(lista, posicao);
+                break;
+            case 8:
+                printf("Itens cadastrados: %d\n", tamanho(lista));
+                break;
+            case 9:
+                excluir_lista(lista);
+                break;
+            case 10:
+                carregar_dados(lista);
+                break;
+            case 11:
+                salvar_dados(lista);
+                break;
+            case 12:
+                printf("\n------ INSERIR ITEM NO CATALOGO -------\n\n");
+                printf("Digite o modelo do processador: ");
+                scanf(" %[^\n]", p->modelo);
+                printf("Digite o numero de cores: ");
+                scanf("%d", &p->numero_cores);
+                printf("Digite o numero de threads: ");
+                scanf("%d", &p->numero_threads);
+                printf("Digite a litografia: ");
+                scanf("%d", &p->litografia_nm);
+                printf("Digite o clock basico: ");
+                scanf("%f", &p->clock_basico_ghz);
+                printf("Digite o clock maximo: ");
+                scanf("%f", &p->clock_maximo_ghz);
+                printf("Digite a TDP: ");
+                scanf("%d", &p->tdp_watts);
+                printf("Digite se o processador possui video integrado( s para sim ou n para nao): ");
+                scanf(" %c", &p->video_integrado);
+
+                inserir_catalogo(catalogo, p);
+                break;
+            case 13:
+                printf("\n------ REMOVER ITEM DO CATALOGO -------\n\n");
+                printf("Digite a posicao do item a ser removido: ");
+                scanf("%d", &posicao);
+                remover_catalogo(catalogo, posicao);
+                break;
+            case 14:
+                printf("\n------ ALTERAR ITEM DO CATALOGO -------\n\n");
+                printf("Digite o modelo do processador: ");
+                scanf(" %[^\n]", p->modelo);
+                printf("Digite o numero de cores: ");
+                scanf("%d", &p->numero_cores);
+                printf("Digite o numero de threads: ");
+                scanf("%d", &p->numero_threads);
+                printf("Digite a litografia: ");
+                scanf("%d", &p->litografia_nm);
+                printf("Digite o clock basico: ");
+                scanf("%f", &p->clock_basico_ghz);
+                printf("Digite o clock maximo: ");
+                scanf("%f", &p->clock_maximo_ghz);
+                printf("Digite a TDP: ");
+                scanf("%d", &p->tdp_watts);
+                printf("Digite se o processador possui video integrado( s para sim ou n para nao): ");
+                scanf(" %c", &p->video_integrado);
+                printf("Digite a posicao do item a ser alterado: ");
+                scanf("%d", &posicao);
+
+                atualizar_catalogo(catalogo, p, posicao);
+                break;
+            case 15:
+                printf("\n------ PESQUISAR ITEM DO CATALOGO -------\n\n");
+                printf("Digite a posicao do item a ser pesquisado: ");
+                scanf("%d", &posicao);
+
+                buscar_catalogo(catalogo, posicao);
+                break;
+            case 16:
+                printf("\n------ PESQUISAR MODELO DO CATALOGO -------\n\n");
+                printf("Digite o modelo do processador: ");
+                scanf(" %[^\n]", p->modelo);
+
+                buscar_catalogo_modelo(catalogo, p->modelo);
+                break;
+            case 17:
+                printf("Digite o numero minimo de cores: ");
+                scanf("%d", &min_cores);
+                printf("Itens com pelo menos %d cores: %d\n", min_cores, filtrar_catalogo(catalogo, min_cores));
+                break;
+            case 18:
+                printf("Itens no catalogo: %d\n", tamanho_catalogo(catalogo));
+                break;
+            case 19:
+                carregar_catalogo(catalogo, PREFIXO_CATALOGO);
+                break;
+            case 20:
+                salvar_catalogo(catalogo, PREFIXO_CATALOGO);
+                break;
+            case 0:
+                printf("Programa encerrado!");
+
+                // Libera a memria alocada para as estruturas
+                free(p);
+                free(lista->itens);
+                free(lista);
+                excluir_catalogo(catalogo);
+                break;
+            default:
+                printf("\nOpcao invalida\n");
+        }
+
+    // No encerra o programa at que o usurio solicite
+    }while(opcao != 0);
+
+    return 0;
+}
+
+#endif